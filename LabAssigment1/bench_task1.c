@@ -0,0 +1,818 @@
+// Benchmark harness for task1.
+//
+// Build: gcc -O2 -pthread -o bench_task1 bench_task1.c
+// Run:   ./bench_task1 [max_threads] > bench.json
+//
+// task1 is included directly so the harness measures the same functions the
+// program runs. Search results are printed by task1 itself, so stdout is sent
+// to /dev/null while timing and the JSON report goes to the original stdout.
+
+#define TASK1_NO_MAIN
+#include "task1"
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define MIN_SECONDS  0.2      // Repeat each measurement for at least this long
+#define NUM_QUERIES  100000   // Point queries per batch
+#define NUM_MOD      200000   // Modular queries per batch
+#define QUERY_TERMS  1000000  // Table size used by the query benchmarks
+#define MOD_PRIME    1000000007ULL
+
+static FILE *json;  // Report stream (the real stdout)
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// xorshift64 so runs are reproducible
+static uint64_t rng_state = 88172645463325252ULL;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static double rng_unit(void) {
+    return (rng_next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* ========= Table generation ========= */
+
+static int gen_threads;  // Thread budget for generation, 0 for the whole machine
+
+static void* gen_budgeted(void *a) {
+    thread_budget = gen_threads;
+    return fibonacci_sequence_gen(a);
+}
+
+static void run_gen(void) {
+    pthread_t t;
+    pthread_create(&t, NULL, gen_budgeted, NULL);
+    pthread_join(t, NULL);
+}
+
+// Limbs held by the current table
+static double table_limbs(void) {
+    double limbs = 0;
+    for (int i = 0; i < built; i++)
+        limbs += term(i).n;
+    return limbs;
+}
+
+// Tables big enough to be segmented are swept over 1 .. max_threads threads
+static void bench_generation(int max_threads) {
+    static const int sizes[] = { 40, 1000, 100000, 1000000 };
+    int nsizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    // Exact tables grow quadratically in limbs, so the largest size is only
+    // generated modulo a prime
+    fprintf(json, "  \"generation\": [\n");
+    for (int mod = 0; mod <= 1; mod++) {
+        modulus = mod ? MOD_PRIME : 0;
+        for (int s = 0; s < nsizes; s++) {
+            if (!mod && sizes[s] > MAX_TERMS)
+                continue;
+            y = sizes[s];
+            int sweep = y >= GEN_PARALLEL_MIN ? max_threads : 1;
+            for (int t = 1; t <= sweep; t++) {
+                gen_threads = t;
+                long reps = 0;
+                double limbs = 0;
+                double start = now_sec(), elapsed;
+                do {
+                    run_gen();
+                    limbs = table_limbs();
+                    fibonacci_table_free();
+                    reps++;
+                    elapsed = now_sec() - start;
+                } while (elapsed < MIN_SECONDS);
+
+                double ns_per_term = elapsed * 1e9 / ((double) reps * y);
+                // Each term reads two terms and writes one
+                double bytes = 3.0 * sizeof(uint64_t) * limbs * reps;
+                fprintf(json, "    { \"strategy\": \"%s\", \"threads\": %d, \"mode\": \"%s\", \"n\": %d, "
+                        "\"ns_per_op\": %.3f, \"gb_per_s\": %.3f },\n",
+                        t > 1 ? "segmented" : "serial", t,
+                        mod ? "mod" : "exact", y, ns_per_term, bytes / elapsed / 1e9);
+            }
+        }
+    }
+    modulus = 0;
+    gen_threads = 0;
+
+    // Memory bandwidth for reference: reduced terms are one flat array per
+    // chunk and exact limbs one heap, so generation streams and should
+    // approach a plain copy
+    size_t copy_bytes = (size_t) 64 << 20;
+    char *src = (char*) xmalloc(copy_bytes), *dst = (char*) xmalloc(copy_bytes);
+    memset(src, 1, copy_bytes);
+    memset(dst, 0, copy_bytes);
+    long reps = 0;
+    double start = now_sec(), elapsed;
+    do {
+        memcpy(dst, src, copy_bytes);
+        src[reps % copy_bytes] = (char) reps;
+        reps++;
+        elapsed = now_sec() - start;
+    } while (elapsed < MIN_SECONDS);
+    fprintf(json, "    { \"strategy\": \"memcpy\", \"threads\": 1, \"mode\": \"reference\", \"n\": %zu, "
+            "\"ns_per_op\": %.3f, \"gb_per_s\": %.3f }\n",
+            copy_bytes, elapsed * 1e9 / reps, 2.0 * copy_bytes * reps / elapsed / 1e9);
+    free(src);
+    free(dst);
+    fprintf(json, "  ],\n");
+}
+
+/* ========= Point and batch queries ========= */
+
+// Uniform indices over the whole table, or skewed toward small indices (u^4)
+static void fill_queries(int *q, int n, int skewed) {
+    for (int i = 0; i < n; i++) {
+        double u = rng_unit();
+        if (skewed)
+            u = u * u * u * u;
+        q[i] = (int) (u * y);
+    }
+}
+
+// Bytes a batch reads per query: the index, then the reduced term, or the
+// exact term's offset, length and limbs
+static double query_bytes(const int *q, int n) {
+    double bytes = 0;
+    for (int i = 0; i < n; i++) {
+        bytes += sizeof(int) + sizeof(uint64_t);
+        if (!modulus)
+            bytes += sizeof(uint32_t) + term(q[i]).n * sizeof(uint64_t);
+    }
+    return bytes / n;
+}
+
+// Runs the search stage over the batch split evenly across nthreads
+static double time_search(int *q, int n, int nthreads) {
+    pthread_t *threads = xmalloc(nthreads * sizeof(pthread_t));
+    search_args_t *args = xmalloc(nthreads * sizeof(search_args_t));
+    long reps = 0;
+    double start = now_sec(), elapsed;
+
+    z = n;
+    do {
+        for (int t = 0; t < nthreads; t++) {
+            args[t].indices = q;
+            args[t].values = NULL;
+            args[t].ranges = NULL;
+            args[t].first = 0;
+            args[t].begin = (int) ((long) n * t / nthreads);
+            args[t].end = (int) ((long) n * (t + 1) / nthreads);
+            pthread_create(&threads[t], NULL, fibonacci_value_search, &args[t]);
+        }
+        for (int t = 0; t < nthreads; t++)
+            pthread_join(threads[t], NULL);
+        fflush(stdout);
+        reps++;
+        elapsed = now_sec() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    free(threads);
+    free(args);
+    return elapsed * 1e9 / ((double) reps * n);
+}
+
+static void bench_queries(int max_threads) {
+    int *q = xmalloc(NUM_QUERIES * sizeof(int));
+
+    modulus = MOD_PRIME;
+    y = QUERY_TERMS;
+    run_gen();
+
+    fprintf(json, "  \"point_queries\": [\n");
+    for (int skewed = 0; skewed <= 1; skewed++) {
+        fill_queries(q, NUM_QUERIES, skewed);
+        double ns = time_search(q, NUM_QUERIES, 1);
+        double bytes = query_bytes(q, NUM_QUERIES);
+        fprintf(json, "    { \"strategy\": \"sorted\", \"distribution\": \"%s\", \"n\": %d, "
+                "\"ns_per_op\": %.3f, \"gb_per_s\": %.3f }%s\n",
+                skewed ? "skewed" : "uniform", y, ns,
+                bytes / ns, skewed ? "" : ",");
+    }
+    fprintf(json, "  ],\n");
+
+    fill_queries(q, NUM_QUERIES, 0);
+    double bytes = query_bytes(q, NUM_QUERIES);
+    fprintf(json, "  \"batch_search\": [\n");
+    double base = 0;
+    for (int t = 1; t <= max_threads; t++) {
+        double ns = time_search(q, NUM_QUERIES, t);
+        if (t == 1)
+            base = ns;
+        fprintf(json, "    { \"strategy\": \"sorted\", \"threads\": %d, \"ns_per_op\": %.3f, "
+                "\"gb_per_s\": %.3f, \"speedup\": %.3f }%s\n",
+                t, ns, bytes / ns, base / ns, t < max_threads ? "," : "");
+    }
+    fprintf(json, "  ],\n");
+
+    fibonacci_table_free();
+    modulus = 0;
+    free(q);
+}
+
+/* ========= Lazy table extent ========= */
+
+// Whole run (generation + search) for a declared table of QUERY_TERMS terms:
+// the full table, versus only what table_extent says the batch needs
+static void bench_lazy(void) {
+    int *q = xmalloc(NUM_QUERIES * sizeof(int));
+    static const char *batches[] = { "low-indices", "sparse" };
+    int sizes[] = { NUM_QUERIES, 100 };
+
+    modulus = MOD_PRIME;
+    y = QUERY_TERMS;
+    fprintf(json, "  \"lazy_extent\": [\n");
+    for (int b = 0; b < 2; b++) {
+        int n = sizes[b];
+        for (int i = 0; i < n; i++)
+            q[i] = b == 0 ? (int) (rng_next() % 1000) : (int) (rng_next() % y);
+        for (int lazy = 0; lazy <= 1; lazy++) {
+            search_args_t args = { .indices = q, .begin = 0, .end = n };
+            long reps = 0;
+            int extent = 0;
+            double start = now_sec(), elapsed;
+            z = n;
+            do {
+                extent = lazy ? table_extent(q, n) : y;
+                pthread_t t;
+                pthread_create(&t, NULL, fibonacci_sequence_gen, &extent);
+                pthread_join(t, NULL);
+                pthread_create(&t, NULL, fibonacci_value_search, &args);
+                pthread_join(t, NULL);
+                fflush(stdout);
+                fibonacci_table_free();
+                reps++;
+                elapsed = now_sec() - start;
+            } while (elapsed < MIN_SECONDS);
+            fprintf(json, "    { \"strategy\": \"%s\", \"batch\": \"%s\", \"queries\": %d, "
+                    "\"terms_built\": %d, \"ns_per_op\": %.3f }%s\n",
+                    lazy ? "lazy" : "full", batches[b], n, extent,
+                    elapsed * 1e9 / ((double) reps * n), b == 1 && lazy ? "" : ",");
+        }
+    }
+    fprintf(json, "  ],\n");
+    modulus = 0;
+    free(q);
+}
+
+/* ========= Modular queries ========= */
+
+static void bench_modular(void) {
+    uint64_t *n = xmalloc(NUM_MOD * sizeof(uint64_t));
+    for (int i = 0; i < NUM_MOD; i++)
+        n[i] = rng_next() >> 2;
+
+    volatile uint64_t sink = 0;
+    long reps = 0;
+    double start = now_sec(), elapsed;
+    do {
+        for (int i = 0; i < NUM_MOD; i++)
+            sink += fibonacci_mod(n[i], MOD_PRIME);
+        reps++;
+        elapsed = now_sec() - start;
+    } while (elapsed < MIN_SECONDS);
+    (void) sink;
+
+    fprintf(json, "  \"modular_queries\": [\n");
+    fprintf(json, "    { \"strategy\": \"fast-doubling\", \"modulus\": %llu, \"ns_per_op\": %.3f }\n",
+            MOD_PRIME, elapsed * 1e9 / ((double) reps * NUM_MOD));
+    fprintf(json, "  ],\n");
+    free(n);
+}
+
+/* ========= Multi-modulus evaluation ========= */
+
+#define NUM_MULTI 16  // Moduli per batch: one AVX-512 group, two AVX2 groups
+
+// F(n) mod 16 primes per n: each modulus on its own, then the batch kernel
+static void bench_multi_modulus(void) {
+    uint32_t p[NUM_MULTI];
+    for (int j = 0; j < NUM_MULTI; j++)
+        p[j] = 2147483647u - 2 * (uint32_t) (rng_next() % 1000000);  // Odd, near 2^31
+    uint64_t *n = xmalloc(NUM_MOD / NUM_MULTI * sizeof(uint64_t));
+    int count = NUM_MOD / NUM_MULTI;
+    for (int i = 0; i < count; i++)
+        n[i] = rng_next() >> 2;
+
+    static const char *names[] = { "separate", "montgomery-scalar", "batch" };
+    double ns[3];
+    for (int s = 0; s < 3; s++) {
+        volatile uint64_t sink = 0;
+        uint32_t out[NUM_MULTI];
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            for (int i = 0; i < count; i++) {
+                if (s == 0) {
+                    for (int j = 0; j < NUM_MULTI; j++)
+                        out[j] = (uint32_t) fibonacci_mod(n[i], p[j]);
+                } else if (s == 1) {
+                    fib_multi_scalar(n[i], p, NUM_MULTI, out);
+                } else {
+                    fibonacci_mod_multi(n[i], p, NUM_MULTI, out);
+                }
+                sink += out[NUM_MULTI - 1];
+            }
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+        (void) sink;
+        ns[s] = elapsed * 1e9 / ((double) reps * count * NUM_MULTI);
+    }
+
+    fprintf(json, "  \"multi_modulus\": [\n");
+    for (int s = 0; s < 3; s++)
+        fprintf(json, "    { \"strategy\": \"%s\", \"moduli\": %d, \"ns_per_op\": %.3f, "
+                "\"speedup\": %.3f }%s\n",
+                names[s], NUM_MULTI, ns[s], ns[0] / ns[s], s < 2 ? "," : "");
+    fprintf(json, "  ],\n");
+    free(n);
+}
+
+/* ========= Range sums ========= */
+
+// Modular F(l..r) sums with no table: every endpoint by fast doubling.
+// Half the ranges reuse an earlier endpoint, which the batch evaluates once.
+static void bench_range(void) {
+    uint64_t *r = xmalloc(2 * NUM_QUERIES * sizeof(uint64_t));
+    for (int i = 0; i < NUM_QUERIES; i++) {
+        uint64_t a = rng_next() >> 24, b = rng_next() >> 24;
+        if (i % 2 && i > 1)
+            a = r[2 * (rng_next() % i)];
+        r[2*i] = a < b ? a : b;
+        r[2*i + 1] = a < b ? b : a;
+    }
+
+    modulus = MOD_PRIME;
+    search_args_t args = { .ranges = r, .begin = 0, .end = NUM_QUERIES };
+    long reps = 0;
+    double start = now_sec(), elapsed;
+    do {
+        pthread_t t;
+        pthread_create(&t, NULL, fibonacci_range_search, &args);
+        pthread_join(t, NULL);
+        fflush(stdout);
+        reps++;
+        elapsed = now_sec() - start;
+    } while (elapsed < MIN_SECONDS);
+    modulus = 0;
+
+    fprintf(json, "  \"range_sums\": [\n");
+    fprintf(json, "    { \"strategy\": \"shared-endpoints\", \"modulus\": %llu, \"ns_per_op\": %.3f }\n",
+            MOD_PRIME, elapsed * 1e9 / ((double) reps * NUM_QUERIES));
+    fprintf(json, "  ],\n");
+    free(r);
+}
+
+/* ========= Fixed-width fast path ========= */
+
+static void bench_fixed_width(void) {
+    int *n = xmalloc(NUM_MOD * sizeof(int));
+    for (int i = 0; i < NUM_MOD; i++)
+        n[i] = (int) (rng_next() % (FIB128_MAX + 1));
+
+    volatile uint64_t sink = 0;
+    long reps = 0;
+    double start = now_sec(), elapsed;
+    do {
+        for (int i = 0; i < NUM_MOD; i++)
+            sink += (uint64_t) fibonacci_small(n[i]);
+        reps++;
+        elapsed = now_sec() - start;
+    } while (elapsed < MIN_SECONDS);
+    (void) sink;
+
+    fprintf(json, "  \"fixed_width\": [\n");
+    fprintf(json, "    { \"strategy\": \"rodata\", \"max_n\": %d, \"ns_per_op\": %.3f }\n",
+            FIB128_MAX, elapsed * 1e9 / ((double) reps * NUM_MOD));
+    fprintf(json, "  ],\n");
+    free(n);
+}
+
+/* ========= Leading and trailing digits ========= */
+
+static void bench_edge_digits(void) {
+    uint64_t *n = xmalloc(NUM_MOD * sizeof(uint64_t));
+    for (int i = 0; i < NUM_MOD; i++)
+        n[i] = rng_next();
+
+    fprintf(json, "  \"edge_digits\": [\n");
+    for (int lead = 1; lead >= 0; lead--) {
+        volatile uint64_t sink = 0;
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            for (int i = 0; i < NUM_MOD; i++) {
+                uint64_t d = 0;
+                if (lead)
+                    fibonacci_leading(n[i], EDGE_MAX_DIGITS, &d);
+                else
+                    d = fibonacci_trailing(n[i], EDGE_MAX_DIGITS);
+                sink += d;
+            }
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+        (void) sink;
+        fprintf(json, "    { \"strategy\": \"%s\", \"digits\": %d, \"ns_per_op\": %.3f }%s\n",
+                lead ? "log10-fixed-point" : "fast-doubling-mod-10^k", EDGE_MAX_DIGITS,
+                elapsed * 1e9 / ((double) reps * NUM_MOD), lead ? "," : "");
+    }
+    fprintf(json, "  ],\n");
+    free(n);
+}
+
+/* ========= Exact point evaluation ========= */
+
+static void bench_point_eval(void) {
+    static const uint64_t idx[] = { 10000, 100000, 1000000, 10000000 };
+    int nidx = sizeof(idx) / sizeof(idx[0]);
+
+    fprintf(json, "  \"point_eval\": [\n");
+    for (int i = 0; i < nidx; i++) {
+        bn_t f = { NULL, 0, 0 }, f1 = { NULL, 0, 0 };
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            fibonacci_pair(idx[i], &f, &f1);
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+
+        fprintf(json, "    { \"strategy\": \"fast-doubling\", \"n\": %" PRIu64 ", \"limbs\": %zu, "
+                "\"ns_per_op\": %.3f }%s\n",
+                idx[i], f.n, elapsed * 1e9 / reps, i + 1 < nidx ? "," : "");
+        bn_free(&f);
+        bn_free(&f1);
+    }
+    fprintf(json, "  ],\n");
+}
+
+/* ========= Memo cache ========= */
+
+// Point queries clustered in a few hot neighborhoods, answered by plain fast
+// doubling and through the shared cache (which starts empty for each run)
+static void bench_memo(void) {
+    enum { HOT = 8, QUERIES = 1000, SPREAD = 64 };
+    uint64_t *n = (uint64_t*) xmalloc(QUERIES * sizeof(uint64_t));
+    for (int i = 0; i < QUERIES; i++)
+        n[i] = 200000 + (rng_next() % HOT) * 12347 + rng_next() % SPREAD;
+
+    fprintf(json, "  \"memo_cache\": [\n");
+    for (int cached = 0; cached <= 1; cached++) {
+        bn_t f = { NULL, 0, 0 }, f1 = { NULL, 0, 0 };
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            memo_cache_free();
+            for (int i = 0; i < QUERIES; i++) {
+                if (cached)
+                    fibonacci_pair_cached(n[i], &f, &f1);
+                else
+                    fibonacci_pair(n[i], &f, &f1);
+            }
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+        memo_cache_free();
+        bn_free(&f);
+        bn_free(&f1);
+
+        fprintf(json, "    { \"strategy\": \"%s\", \"neighborhoods\": %d, \"spread\": %d, "
+                "\"ns_per_op\": %.3f }%s\n", cached ? "memo-cache" : "fast-doubling",
+                HOT, SPREAD, elapsed * 1e9 / ((double) reps * QUERIES), cached ? "" : ",");
+    }
+    fprintf(json, "  ],\n");
+    free(n);
+}
+
+/* ========= Index-keyed checkpoint store ========= */
+
+// F(n) for n just past (and twice) a checkpointed index, resumed from the
+// checkpoint on disk against computed from scratch
+static void bench_checkpoint(void) {
+    static const uint64_t base = 10000000;
+    static const struct { const char *step; uint64_t n; } q[] = {
+        { "additions", 10000003 }, { "addition-formula", 10050000 }, { "doubling", 20000001 },
+    };
+    int nq = sizeof(q) / sizeof(q[0]);
+    char dir[] = "/tmp/bench_task1_ckpt.XXXXXX";
+    if (!mkdtemp(dir))
+        return;
+
+    bn_t f = { NULL, 0, 0 }, f1 = { NULL, 0, 0 };
+    checkpoint_dir = dir;
+    fibonacci_pair_stored(base, &f, &f1);
+
+    fprintf(json, "  \"checkpoint_store\": [\n");
+    for (int i = 0; i < nq; i++) {
+        double t[2];
+        for (int stored = 0; stored <= 1; stored++) {
+            long reps = 0;
+            double start = now_sec(), elapsed;
+            do {
+                char path[64];
+                snprintf(path, sizeof(path), "%s/%016" PRIx64 ".fib", dir, q[i].n);
+                unlink(path);  // Only the base checkpoint may help
+                memo_cache_free();
+                if (stored)
+                    fibonacci_pair_stored(q[i].n, &f, &f1);
+                else
+                    fibonacci_pair(q[i].n, &f, &f1);
+                reps++;
+                elapsed = now_sec() - start;
+            } while (elapsed < MIN_SECONDS);
+            t[stored] = elapsed * 1e9 / reps;
+        }
+        fprintf(json, "    { \"step\": \"%s\", \"checkpoint\": %" PRIu64 ", \"n\": %" PRIu64 ", "
+                "\"scratch_ns\": %.3f, \"resumed_ns\": %.3f }%s\n", q[i].step, base, q[i].n,
+                t[0], t[1], i + 1 < nq ? "," : "");
+    }
+    fprintf(json, "  ],\n");
+
+    DIR *d = opendir(dir);
+    struct dirent *ent;
+    while (d && (ent = readdir(d)) != NULL) {
+        char path[320];
+        snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+        if (strcmp(ent->d_name, ".") != 0 && strcmp(ent->d_name, "..") != 0)
+            unlink(path);
+    }
+    if (d)
+        closedir(d);
+    rmdir(dir);
+    checkpoint_dir = NULL;
+    memo_cache_free();
+    bn_free(&f);
+    bn_free(&f1);
+}
+
+/* ========= Zeckendorf representations ========= */
+
+// Greedy Zeckendorf that scans the table downward for each term
+static void zeckendorf_linear(const bn_t *v, bn_t *bits) {
+    bn_t r = { NULL, 0, 0 };
+    bn_copy(&r, v);
+    bn_reserve(bits, (size_t) built / 64 + 1);
+    memset(bits->d, 0, ((size_t) built / 64 + 1) * sizeof(uint64_t));
+    bits->n = 0;
+    for (int i = built - 1; r.n && i >= 2; i--) {
+        bn_t t = term(i);
+        if (bn_cmp(&t, &r) <= 0) {
+            bits->d[(i - 2) / 64] |= 1ull << ((i - 2) % 64);
+            if (bits->n < (size_t) (i - 2) / 64 + 1)
+                bits->n = (i - 2) / 64 + 1;
+            bn_sub(&r, &r, &t);
+            i--;
+        }
+    }
+    bn_free(&r);
+}
+
+// Random values of every size up to the table's reach
+static void bench_zeckendorf(void) {
+    enum { TERMS = 20000, VALUES = 2000 };
+    modulus = 0;
+    table_extend(TERMS);
+
+    bn_t *v = (bn_t*) xcalloc(VALUES, sizeof(bn_t));
+    for (int i = 0; i < VALUES; i++) {
+        bn_t t = term(3 + rng_next() % (TERMS - 4));
+        bn_copy(&v[i], &t);
+        for (size_t j = 0; j + 1 < v[i].n; j++)
+            v[i].d[j] = rng_next();
+        v[i].d[v[i].n - 1] = rng_next() % v[i].d[v[i].n - 1];  // Below the term
+        v[i].n = ln_norm(v[i].d, v[i].n);
+    }
+
+    fprintf(json, "  \"zeckendorf\": [\n");
+    for (int binary = 0; binary <= 1; binary++) {
+        bn_t bits = { NULL, 0, 0 };
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            for (int i = 0; i < VALUES; i++) {
+                if (binary)
+                    zeckendorf(&v[i], &bits);
+                else
+                    zeckendorf_linear(&v[i], &bits);
+            }
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+        bn_free(&bits);
+
+        fprintf(json, "    { \"strategy\": \"%s\", \"terms\": %d, \"ns_per_op\": %.3f }%s\n",
+                binary ? "greedy-gallop-binary-search" : "greedy-linear-scan", TERMS,
+                elapsed * 1e9 / ((double) reps * VALUES), binary ? "" : ",");
+    }
+    fprintf(json, "  ],\n");
+
+    for (int i = 0; i < VALUES; i++)
+        bn_free(&v[i]);
+    free(v);
+    fibonacci_table_free();
+}
+
+/* ========= Work-stealing pool ========= */
+
+typedef struct {
+    const uint64_t *points;
+    bn_t *values;
+    int begin, end;
+    double busy;
+} static_slice_t;
+
+// One worker's share of the machine, as the pool gives its workers
+static void* static_slice(void *a) {
+    static_slice_t *s = (static_slice_t*) a;
+    double start = now_sec();
+    thread_budget = 1;
+    for (int i = s->begin; i < s->end; i++)
+        fibonacci_at(s->points[i], &s->values[i]);
+    s->busy = now_sec() - start;
+    return NULL;
+}
+
+// A few giant point evaluations ahead of many tiny ones, on 1 .. max_threads
+// workers: equal static chunks against the work-stealing pool. tail_ratio is
+// the busiest worker's time over the mean.
+static void bench_work_stealing(int max_threads) {
+    enum { GIANT = 4, TINY = 20000 };
+    int n = GIANT + TINY;
+    uint64_t *points = (uint64_t*) xmalloc(n * sizeof(uint64_t));
+    bn_t *values = (bn_t*) xcalloc(n, sizeof(bn_t));
+    for (int i = 0; i < n; i++)
+        points[i] = i < GIANT ? 1000000 + 250000 * (uint64_t) i : 100 + rng_next() % 2000;
+
+    fprintf(json, "  \"work_stealing\": [\n");
+    for (int workers = 1; workers <= max_threads; workers++) {
+        for (int pool = 0; pool <= 1; pool++) {
+            double busy_max = 0, busy_sum = 0;
+            int busy_n = 0;
+            long reps = 0;
+            double start = now_sec(), elapsed;
+            do {
+                memo_cache_free();
+                busy_max = busy_sum = 0;
+                busy_n = 0;
+                if (pool) {
+                    stats = 1;
+                    atomic_store(&stats_nworkers, 0);
+                    thread_budget = workers;
+                    point_batch_eval(points, n, values);
+                    thread_budget = 0;
+                    stats = 0;
+                    int ran = (int) atomic_load(&stats_nworkers);
+                    for (int w = 0; w < ran && w < STATS_MAX_WORKERS; w++) {
+                        double b = stats_workers[w].busy;
+                        busy_max = b > busy_max ? b : busy_max;
+                        busy_sum += b;
+                        busy_n++;
+                    }
+                } else {
+                    static_slice_t *s = (static_slice_t*) xmalloc(workers * sizeof(static_slice_t));
+                    pthread_t *tids = (pthread_t*) xmalloc(workers * sizeof(pthread_t));
+                    for (int w = 0; w < workers; w++) {
+                        s[w] = (static_slice_t) { points, values, (int) ((int64_t) n * w / workers),
+                                                  (int) ((int64_t) n * (w + 1) / workers), 0 };
+                        pthread_create(&tids[w], NULL, static_slice, &s[w]);
+                    }
+                    for (int w = 0; w < workers; w++) {
+                        pthread_join(tids[w], NULL);
+                        busy_max = s[w].busy > busy_max ? s[w].busy : busy_max;
+                        busy_sum += s[w].busy;
+                        busy_n++;
+                    }
+                    free(s);
+                    free(tids);
+                }
+                reps++;
+                elapsed = now_sec() - start;
+            } while (elapsed < MIN_SECONDS);
+
+            fprintf(json, "    { \"strategy\": \"%s\", \"workers\": %d, \"giant\": %d, \"tiny\": %d, "
+                    "\"ms_per_batch\": %.3f, \"tail_ratio\": %.3f }%s\n",
+                    pool ? "work-stealing" : "static-chunks", workers, GIANT, TINY,
+                    elapsed * 1e3 / reps, busy_n ? busy_max / (busy_sum / busy_n) : 0,
+                    pool && workers == max_threads ? "" : ",");
+        }
+    }
+    fprintf(json, "  ],\n");
+
+    memo_cache_free();
+    for (int i = 0; i < n; i++)
+        bn_free(&values[i]);
+    free(values);
+    free(points);
+}
+
+/* ========= Reverse lookup ========= */
+
+static void bench_reverse(void) {
+    static const uint64_t idx[] = { 10000, 100000, 1000000 };
+    int nidx = sizeof(idx) / sizeof(idx[0]);
+
+    fprintf(json, "  \"reverse_lookup\": [\n");
+    for (int i = 0; i < nidx; i++) {
+        bn_t f = { NULL, 0, 0 }, f1 = { NULL, 0, 0 };
+        fibonacci_pair(idx[i], &f, &f1);
+
+        volatile int64_t sink = 0;
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            sink += fibonacci_index_of(&f);
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+        (void) sink;
+
+        fprintf(json, "    { \"strategy\": \"estimate+fast-doubling\", \"n\": %" PRIu64 ", "
+                "\"limbs\": %zu, \"ns_per_op\": %.3f }%s\n",
+                idx[i], f.n, elapsed * 1e9 / reps, i + 1 < nidx ? "," : "");
+        bn_free(&f);
+        bn_free(&f1);
+    }
+    fprintf(json, "  ],\n");
+}
+
+/* ========= Decimal output ========= */
+
+static void bench_decimal(void) {
+    static const uint64_t idx[] = { 10000, 100000, 1000000 };
+    int nidx = sizeof(idx) / sizeof(idx[0]);
+
+    fprintf(json, "  \"decimal_output\": [\n");
+    for (int i = 0; i < nidx; i++) {
+        bn_t f = { NULL, 0, 0 }, f1 = { NULL, 0, 0 };
+        fibonacci_pair(idx[i], &f, &f1);
+
+        // The first conversion builds the power tree levels it needs
+        size_t len = 0;
+        free(bn_to_dec_len(&f, &len));
+        long reps = 0;
+        double start = now_sec(), elapsed;
+        do {
+            free(bn_to_dec_len(&f, &len));
+            reps++;
+            elapsed = now_sec() - start;
+        } while (elapsed < MIN_SECONDS);
+
+        fprintf(json, "    { \"strategy\": \"power-tree\", \"n\": %" PRIu64 ", \"digits\": %zu, "
+                "\"ns_per_op\": %.3f, \"ns_per_digit\": %.3f }%s\n",
+                idx[i], len, elapsed * 1e9 / reps, elapsed * 1e9 / reps / len,
+                i + 1 < nidx ? "," : "");
+        bn_free(&f);
+        bn_free(&f1);
+    }
+    fprintf(json, "  ]\n");
+}
+
+int main(int argc, char *argv[]) {
+    int max_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (argc > 1)
+        max_threads = atoi(argv[1]);
+    if (max_threads < 1)
+        max_threads = 1;
+
+    // Keep the real stdout for the report, silence task1's own printing
+    json = fdopen(dup(STDOUT_FILENO), "w");
+    if (json == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+        perror("bench_task1");
+        return 1;
+    }
+
+    fprintf(json, "{\n");
+    bench_generation(max_threads);
+    bench_queries(max_threads);
+    bench_lazy();
+    bench_modular();
+    bench_range();
+    bench_multi_modulus();
+    bench_fixed_width();
+    bench_edge_digits();
+    bench_point_eval();
+    bench_memo();
+    bench_checkpoint();
+    bench_zeckendorf();
+    bench_work_stealing(max_threads);
+    bench_reverse();
+    bench_decimal();
+    fprintf(json, "}\n");
+
+    fclose(json);
+    return 0;
+}
@@ -0,0 +1,206 @@
+// Generated by gen_fib_tables.c -- do not edit.
+//
+// F(0..93) as uint64_t and F(94..186) as {low, high} 64-bit halves.
+
+#ifndef FIB_TABLES_H
+#define FIB_TABLES_H
+
+#include <stdint.h>
+
+#define FIB64_MAX  93
+#define FIB128_MAX 186
+
+static const uint64_t fib64[FIB64_MAX + 1] = {
+    0u,
+    1u,
+    1u,
+    2u,
+    3u,
+    5u,
+    8u,
+    13u,
+    21u,
+    34u,
+    55u,
+    89u,
+    144u,
+    233u,
+    377u,
+    610u,
+    987u,
+    1597u,
+    2584u,
+    4181u,
+    6765u,
+    10946u,
+    17711u,
+    28657u,
+    46368u,
+    75025u,
+    121393u,
+    196418u,
+    317811u,
+    514229u,
+    832040u,
+    1346269u,
+    2178309u,
+    3524578u,
+    5702887u,
+    9227465u,
+    14930352u,
+    24157817u,
+    39088169u,
+    63245986u,
+    102334155u,
+    165580141u,
+    267914296u,
+    433494437u,
+    701408733u,
+    1134903170u,
+    1836311903u,
+    2971215073u,
+    4807526976u,
+    7778742049u,
+    12586269025u,
+    20365011074u,
+    32951280099u,
+    53316291173u,
+    86267571272u,
+    139583862445u,
+    225851433717u,
+    365435296162u,
+    591286729879u,
+    956722026041u,
+    1548008755920u,
+    2504730781961u,
+    4052739537881u,
+    6557470319842u,
+    10610209857723u,
+    17167680177565u,
+    27777890035288u,
+    44945570212853u,
+    72723460248141u,
+    117669030460994u,
+    190392490709135u,
+    308061521170129u,
+    498454011879264u,
+    806515533049393u,
+    1304969544928657u,
+    2111485077978050u,
+    3416454622906707u,
+    5527939700884757u,
+    8944394323791464u,
+    14472334024676221u,
+    23416728348467685u,
+    37889062373143906u,
+    61305790721611591u,
+    99194853094755497u,
+    160500643816367088u,
+    259695496911122585u,
+    420196140727489673u,
+    679891637638612258u,
+    1100087778366101931u,
+    1779979416004714189u,
+    2880067194370816120u,
+    4660046610375530309u,
+    7540113804746346429u,
+    12200160415121876738u,
+};
+
+static const uint64_t fib128[FIB128_MAX - FIB64_MAX][2] = {
+    { 0x11f38ad0840bf6bfu, 0x0000000000000001u },
+    { 0xbb433812a62b1dc1u, 0x0000000000000001u },
+    { 0xcd36c2e32a371480u, 0x0000000000000002u },
+    { 0x8879faf5d0623241u, 0x0000000000000004u },
+    { 0x55b0bdd8fa9946c1u, 0x0000000000000007u },
+    { 0xde2ab8cecafb7902u, 0x000000000000000bu },
+    { 0x33db76a7c594bfc3u, 0x0000000000000013u },
+    { 0x12062f76909038c5u, 0x000000000000001fu },
+    { 0x45e1a61e5624f888u, 0x0000000000000032u },
+    { 0x57e7d594e6b5314du, 0x0000000000000051u },
+    { 0x9dc97bb33cda29d5u, 0x0000000000000083u },
+    { 0xf5b15148238f5b22u, 0x00000000000000d4u },
+    { 0x937accfb606984f7u, 0x0000000000000158u },
+    { 0x892c1e4383f8e019u, 0x000000000000022du },
+    { 0x1ca6eb3ee4626510u, 0x0000000000000386u },
+    { 0xa5d30982685b4529u, 0x00000000000005b3u },
+    { 0xc279f4c14cbdaa39u, 0x0000000000000939u },
+    { 0x684cfe43b518ef62u, 0x0000000000000eedu },
+    { 0x2ac6f30501d6999bu, 0x0000000000001827u },
+    { 0x9313f148b6ef88fdu, 0x0000000000002714u },
+    { 0xbddae44db8c62298u, 0x0000000000003f3bu },
+    { 0x50eed5966fb5ab95u, 0x0000000000006650u },
+    { 0x0ec9b9e4287bce2du, 0x000000000000a58cu },
+    { 0x5fb88f7a983179c2u, 0x0000000000010bdcu },
+    { 0x6e82495ec0ad47efu, 0x000000000001b168u },
+    { 0xce3ad8d958dec1b1u, 0x000000000002bd44u },
+    { 0x3cbd2238198c09a0u, 0x0000000000046eadu },
+    { 0x0af7fb11726acb51u, 0x0000000000072bf2u },
+    { 0x47b51d498bf6d4f1u, 0x00000000000b9a9fu },
+    { 0x52ad185afe61a042u, 0x000000000012c691u },
+    { 0x9a6235a48a587533u, 0x00000000001e6130u },
+    { 0xed0f4dff88ba1575u, 0x00000000003127c1u },
+    { 0x877183a413128aa8u, 0x00000000004f88f2u },
+    { 0x7480d1a39bcca01du, 0x000000000080b0b4u },
+    { 0xfbf25547aedf2ac5u, 0x0000000000d039a6u },
+    { 0x707326eb4aabcae2u, 0x000000000150ea5bu },
+    { 0x6c657c32f98af5a7u, 0x0000000002212402u },
+    { 0xdcd8a31e4436c089u, 0x0000000003720e5du },
+    { 0x493e1f513dc1b630u, 0x0000000005933260u },
+    { 0x2616c26f81f876b9u, 0x00000000090540beu },
+    { 0x6f54e1c0bfba2ce9u, 0x000000000e98731eu },
+    { 0x956ba43041b2a3a2u, 0x00000000179db3dcu },
+    { 0x04c085f1016cd08bu, 0x00000000263626fbu },
+    { 0x9a2c2a21431f742du, 0x000000003dd3dad7u },
+    { 0x9eecb012448c44b8u, 0x00000000640a01d2u },
+    { 0x3918da3387abb8e5u, 0x00000000a1dddcaau },
+    { 0xd8058a45cc37fd9du, 0x0000000105e7de7cu },
+    { 0x111e647953e3b682u, 0x00000001a7c5bb27u },
+    { 0xe923eebf201bb41fu, 0x00000002adad99a3u },
+    { 0xfa42533873ff6aa1u, 0x00000004557354cau },
+    { 0xe36641f7941b1ec0u, 0x000000070320ee6eu },
+    { 0xdda89530081a8961u, 0x0000000b58944339u },
+    { 0xc10ed7279c35a821u, 0x000000125bb531a8u },
+    { 0x9eb76c57a4503182u, 0x0000001db44974e2u },
+    { 0x5fc6437f4085d9a3u, 0x000000300ffea68bu },
+    { 0xfe7dafd6e4d60b25u, 0x0000004dc4481b6du },
+    { 0x5e43f356255be4c8u, 0x0000007dd446c1f9u },
+    { 0x5cc1a32d0a31efedu, 0x000000cb988edd67u },
+    { 0xbb0596832f8dd4b5u, 0x000001496cd59f60u },
+    { 0x17c739b039bfc4a2u, 0x0000021505647cc8u },
+    { 0xd2ccd033694d9957u, 0x0000035e723a1c28u },
+    { 0xea9409e3a30d5df9u, 0x00000573779e98f0u },
+    { 0xbd60da170c5af750u, 0x000008d1e9d8b519u },
+    { 0xa7f4e3faaf685549u, 0x00000e4561774e0au },
+    { 0x6555be11bbc34c99u, 0x000017174b500324u },
+    { 0x0d4aa20c6b2ba1e2u, 0x0000255cacc7512fu },
+    { 0x72a0601e26eeee7bu, 0x00003c73f8175453u },
+    { 0x7feb022a921a905du, 0x000061d0a4dea582u },
+    { 0xf28b6248b9097ed8u, 0x00009e449cf5f9d5u },
+    { 0x727664734b240f35u, 0x0001001541d49f58u },
+    { 0x6501c6bc042d8e0du, 0x00019e59deca992eu },
+    { 0xd7782b2f4f519d42u, 0x00029e6f209f3886u },
+    { 0x3c79f1eb537f2b4fu, 0x00043cc8ff69d1b5u },
+    { 0x13f21d1aa2d0c891u, 0x0006db3820090a3cu },
+    { 0x506c0f05f64ff3e0u, 0x000b18011f72dbf1u },
+    { 0x645e2c209920bc71u, 0x0011f3393f7be62du },
+    { 0xb4ca3b268f70b051u, 0x001d0b3a5eeec21eu },
+    { 0x1928674728916cc2u, 0x002efe739e6aa84cu },
+    { 0xcdf2a26db8021d13u, 0x004c09adfd596a6au },
+    { 0xe71b09b4e09389d5u, 0x007b08219bc412b6u },
+    { 0xb50dac229895a6e8u, 0x00c711cf991d7d21u },
+    { 0x9c28b5d7792930bdu, 0x014219f134e18fd8u },
+    { 0x513661fa11bed7a5u, 0x02092bc0cdff0cfau },
+    { 0xed5f17d18ae80862u, 0x034b45b202e09cd2u },
+    { 0x3e9579cb9ca6e007u, 0x05547172d0dfa9cdu },
+    { 0x2bf4919d278ee869u, 0x089fb724d3c046a0u },
+    { 0x6a8a0b68c435c870u, 0x0df42897a49ff06du },
+    { 0x967e9d05ebc4b0d9u, 0x1693dfbc7860370du },
+    { 0x0108a86eaffa7949u, 0x248808541d00277bu },
+    { 0x978745749bbf2a22u, 0x3b1be81095605e88u },
+    { 0x988fede34bb9a36bu, 0x5fa3f064b2608603u },
+    { 0x30173357e778cd8du, 0x9abfd87547c0e48cu },
+    { 0xc8a7213b333270f8u, 0xfa63c8d9fa216a8fu },
+};
+
+#endif
@@ -0,0 +1,41 @@
+// Generates fib_tables.h, the read-only Fibonacci tables behind task1's
+// fixed-width fast path.
+//
+// Build: gcc -o gen_fib_tables gen_fib_tables.c
+// Run:   ./gen_fib_tables > fib_tables.h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#define FIB64_MAX  93   // Largest n with F(n) < 2^64
+#define FIB128_MAX 186  // Largest n with F(n) < 2^128
+
+int main(void) {
+    unsigned __int128 a = 0, b = 1;  // F(n), F(n+1)
+
+    printf("// Generated by gen_fib_tables.c -- do not edit.\n");
+    printf("//\n");
+    printf("// F(0..%d) as uint64_t and F(%d..%d) as {low, high} 64-bit halves.\n\n",
+           FIB64_MAX, FIB64_MAX + 1, FIB128_MAX);
+    printf("#ifndef FIB_TABLES_H\n#define FIB_TABLES_H\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#define FIB64_MAX  %d\n", FIB64_MAX);
+    printf("#define FIB128_MAX %d\n\n", FIB128_MAX);
+
+    printf("static const uint64_t fib64[FIB64_MAX + 1] = {\n");
+    for (int n = 0; n <= FIB128_MAX; n++) {
+        if (n == FIB64_MAX + 1)
+            printf("};\n\nstatic const uint64_t fib128[FIB128_MAX - FIB64_MAX][2] = {\n");
+        if (n <= FIB64_MAX)
+            printf("    %" PRIu64 "u,\n", (uint64_t) a);
+        else
+            printf("    { 0x%016" PRIx64 "u, 0x%016" PRIx64 "u },\n",
+                   (uint64_t) a, (uint64_t) (a >> 64));
+        unsigned __int128 t = a + b;
+        a = b;
+        b = t;
+    }
+    printf("};\n\n#endif\n");
+    return 0;
+}